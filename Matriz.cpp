@@ -2,6 +2,15 @@
 #include <iomanip>
 #include <cstring>
 #include <cmath>
+#include <cfloat>
+#include <algorithm>
+#include <vector>
+#include <atomic>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MATRIZ_X86
+#include <immintrin.h>
+#endif
 
 #include "Matriz.hpp"
 
@@ -25,6 +34,8 @@ void Matriz::EstablecerDim(int m, int n)
 //Constructor
 Matriz::Matriz(int m, int n) {
     EstablecerDim(m, n);
+    capM = m;
+    capN = n;
     try {
         componente = new tipo*[m];
         componente[0] = new tipo[m * n];
@@ -38,13 +49,14 @@ Matriz::Matriz(int m, int n) {
             }
         }
     } catch(std::bad_alloc &) {
+        delete[] componente;
         throw "No es posible construir una Matriz";
     }
 }
 
 //***********************************
 // Constructor de copia
-Matriz::Matriz(const Matriz &v) : m(v.m), n(v.n), componente(nullptr) {
+Matriz::Matriz(const Matriz &v) : m(v.m), n(v.n), capM(v.m), capN(v.n), componente(nullptr), usarCache(v.usarCache) {
     try {
         componente = new tipo*[m];
         componente[0] = new tipo[m * n];
@@ -58,6 +70,7 @@ Matriz::Matriz(const Matriz &v) : m(v.m), n(v.n), componente(nullptr) {
             }
         }
     } catch(std::bad_alloc &) {
+        delete[] componente;
         throw "No es posible construir una Matriz";
     }
 }
@@ -65,27 +78,24 @@ Matriz::Matriz(const Matriz &v) : m(v.m), n(v.n), componente(nullptr) {
 // Operador de asignacin
 Matriz & Matriz::operator=(const Matriz &v) {
     if (this == &v) return *this;
-    try {
-        delete[] componente[0];
-        delete[] componente;
-        componente = nullptr;
+    if (v.m > capM || v.n > capN) {
+        // Se reserva en una copia temporal para que un fallo deje intacta esta matriz
+        Matriz temporal(v);
+        Intercambiar(temporal);
+        usarCache = v.usarCache;
+        return *this;
+    }
 
-        m = v.m;
-        n = v.n;
+    // La capacidad alcanza para la matriz a copiar, as que se reutiliza la memoria
+    InvalidarCache();
+    usarCache = v.usarCache;
+    m = v.m;
+    n = v.n;
 
-        componente = new tipo*[m];
-        componente[0] = new tipo[m * n];
-        for (unsigned int i = 1; i < m; ++i) {
-            componente[i] = componente[0] + i * n;
-        }
-
-        for (unsigned int i = 0; i < m; ++i) {
-            for (unsigned int j = 0; j < n; ++j) {
-                componente[i][j] = v.componente[i][j];
-            }
+    for (unsigned int i = 0; i < m; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            componente[i][j] = v.componente[i][j];
         }
-    } catch (std::bad_alloc &) {
-        throw "No es posible construir una Matriz";
     }
 
     return *this;
@@ -93,6 +103,7 @@ Matriz & Matriz::operator=(const Matriz &v) {
 //***********************************
 // Destructor
 Matriz::~Matriz() {
+        InvalidarCache();
         delete[] componente[0];
         delete[] componente;
         componente = nullptr;
@@ -101,6 +112,7 @@ Matriz::~Matriz() {
 //***********************************
 void Matriz::Capturar()
 {
+    InvalidarCache();
     for(unsigned int i = 0 ; i < m ; ++i){
         for(unsigned int j = 0; j<n; ++j){
                     cin >> componente[i][j];
@@ -154,37 +166,116 @@ void Matriz::Redimensionar(unsigned int nuevo_m, unsigned int nuevo_n)
     if (nuevo_m == m && nuevo_n == n) {
         return;
     }
-    try {
-        tipo** nueva_componente = new tipo*[nuevo_m];
-        nueva_componente[0] = new tipo[nuevo_m * nuevo_n];
-        for (unsigned int i = 1; i < nuevo_m; ++i) {
-            nueva_componente[i] = nueva_componente[0] + i * nuevo_n;
-        }
+    InvalidarCache();
+    if (nuevo_m > capM || nuevo_n > capN) {
+        // Cada dimensin que no cabe al menos duplica su capacidad, para que crecer de poco en poco cueste
+        // O(1) amortizado por elemento, como en AgregarRenglon() y AgregarColumna()
+        Reubicar(nuevo_m > capM ? std::max(nuevo_m, 2 * capM) : capM,
+                 nuevo_n > capN ? std::max(nuevo_n, 2 * capN) : capN);
+    }
 
-        for (unsigned int i = 0; i < nuevo_m; ++i) {
-            for (unsigned int j = 0; j < nuevo_n; ++j) {
-                nueva_componente[i][j] = 0;
-            }
+    // Los valores que siguen siendo vlidos ya estn en su lugar; solo se limpia lo que se agrega
+    for (unsigned int i = 0; i < std::min(m, nuevo_m); ++i) {
+        for (unsigned int j = n; j < nuevo_n; ++j) {
+            componente[i][j] = 0;
         }
-        // Copiar los valores de la matriz original que siguen siendo vlidos
-        for (unsigned int i = 0; i < std::min(m, nuevo_m); ++i) {
-            for (unsigned int j = 0; j < std::min(n, nuevo_n); ++j) {
-                nueva_componente[i][j] = componente[i][j];
-            }
+    }
+    for (unsigned int i = m; i < nuevo_m; ++i) {
+        for (unsigned int j = 0; j < nuevo_n; ++j) {
+            componente[i][j] = 0;
         }
+    }
 
-        // Liberar la memoria de la matriz original
-        delete[] componente[0];
-        delete[] componente;
+    m = nuevo_m;
+    n = nuevo_n;
+}
 
-        // Asignar la nueva matriz redimensionada
-        componente = nueva_componente;
-        m = nuevo_m;
-        n = nuevo_n;
+//***************************************************************************
 
+/* CAPACIDAD */
+//***********************************
+int Matriz::ObtenerCapRen() const
+{
+    return capM;
+}
+//***********************************
+int Matriz::ObtenerCapCol() const
+{
+    return capN;
+}
+//***********************************
+void Matriz::Reservar(unsigned int renglones, unsigned int columnas)
+{
+    if (renglones < 1 || columnas < 1) {
+        throw "Valor fuera de rango para las dimensiones de la matriz";
+    }
+    if (renglones > capM || columnas > capN) {
+        Reubicar(std::max(renglones, capM), std::max(columnas, capN));
+    }
+}
+//***********************************
+void Matriz::AgregarRenglon(const Matriz &renglon)
+{
+    if (renglon.m != 1 || renglon.n != n)
+        throw "Dimensiones incompatibles para agregar el renglon";
+
+    InvalidarCache();
+    if (m == capM) Reubicar(2 * capM, capN);
+
+    // renglon puede ser esta misma matriz, cuyo nico rengln sigue siendo el 0 tras reubicarla
+    for (unsigned int j = 0; j < n; ++j) {
+        componente[m][j] = renglon.componente[0][j];
+    }
+    ++m;
+}
+//***********************************
+void Matriz::AgregarColumna(const Matriz &columna)
+{
+    if (columna.n != 1 || columna.m != m)
+        throw "Dimensiones incompatibles para agregar la columna";
+
+    InvalidarCache();
+    if (n == capN) Reubicar(capM, 2 * capN);
+
+    for (unsigned int i = 0; i < m; ++i) {
+        componente[i][n] = columna.componente[i][0];
+    }
+    ++n;
+}
+//***********************************
+void Matriz::AjustarCapacidad()
+{
+    if (capM != m || capN != n) Reubicar(m, n);
+}
+//***********************************
+// Cambia la capacidad conservando los elementos actuales; la nueva capacidad debe cubrir m x n
+void Matriz::Reubicar(unsigned int nueva_capM, unsigned int nueva_capN)
+{
+    tipo **nueva_componente = nullptr;
+    try {
+        nueva_componente = new tipo*[nueva_capM];
+        nueva_componente[0] = new tipo[nueva_capM * nueva_capN];
     } catch (std::bad_alloc &) {
+        delete[] nueva_componente;
         throw "No es posible construir una Matriz";
     }
+    for (unsigned int i = 1; i < nueva_capM; ++i) {
+        nueva_componente[i] = nueva_componente[0] + i * nueva_capN;
+    }
+
+    for (unsigned int i = 0; i < m; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            nueva_componente[i][j] = componente[i][j];
+        }
+    }
+
+    // Liberar la memoria de la matriz original
+    delete[] componente[0];
+    delete[] componente;
+
+    componente = nueva_componente;
+    capM = nueva_capM;
+    capN = nueva_capN;
 }
 
 
@@ -251,25 +342,73 @@ Matriz Matriz::operator*(double escalar) const
 
     return s;
 }
+//***********************************
+Matriz Matriz::Producto(const Matriz &v) const
+{
+    if (n != v.m)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    Matriz s(m, v.n);
+    Multiplicar(*this, v, s);
+
+    return s;
+}
+//***********************************
+// Escribe ab en c, que ya debe tener las dimensiones correctas y ser distinta de a y de b
+void Matriz::Multiplicar(const Matriz &a, const Matriz &b, Matriz &c)
+{
+    for (unsigned int i = 0; i < a.m; ++i) {
+        tipo *filaC = c.componente[i];
+        for (unsigned int j = 0; j < b.n; ++j) filaC[j] = 0;
+        for (unsigned int k = 0; k < a.n; ++k) {
+            const tipo aik = a.componente[i][k];
+            const tipo *filaB = b.componente[k];
+            for (unsigned int j = 0; j < b.n; ++j) filaC[j] += aik * filaB[j];
+        }
+    }
+}
+//***********************************
+// Intercambia el contenido de dos matrices sin copiar sus elementos
+void Matriz::Intercambiar(Matriz &v)
+{
+    InvalidarCache();
+    v.InvalidarCache();
+    std::swap(m, v.m);
+    std::swap(n, v.n);
+    std::swap(capM, v.capM);
+    std::swap(capN, v.capN);
+    std::swap(componente, v.componente);
+}
 //******************************************************************************
 Matriz Matriz::Transpuesta() const
 {
+    if (usarCache) {
+        const Matriz *guardada = LeerCache(transpuestaCache);
+        if (guardada != nullptr) return *guardada;
+    }
+
     Matriz s(n, m); // Crear una matriz con dimensiones transpuestas (n, m)
     for (unsigned int i = 0; i < m; i++) {
         for (unsigned int j = 0; j < n; j++) {
             s.componente[j][i] = componente[i][j]; // Asignar elementos transpuestos
         }
     }
+    if (usarCache) GuardarCache(transpuestaCache, s);
     return s;
 }
 //******************************************************************************
 tipo Matriz::Determinante() const
 {
     if(n!=m) throw "Dimensiones incorrectas para el determinanate";
+    if (usarCache) {
+        std::lock_guard<std::mutex> bloqueo(cerrojoCache);
+        if (detValido) return detCache;
+    }
+
+    tipo det = 0;
     if (n == 1) {
-        return componente[0][0];
+        det = componente[0][0];
     } else {
-        tipo det = 0;
         Matriz submatriz(n - 1, n - 1);
 
         for (unsigned int i = 0; i < n; ++i) {
@@ -291,9 +430,14 @@ tipo Matriz::Determinante() const
             tipo cofactor = submatriz.Determinante();
             det += signo * componente[0][i] * cofactor;
         }
-        return det;
     }
 
+    if (usarCache) {
+        std::lock_guard<std::mutex> bloqueo(cerrojoCache);
+        detCache = det;
+        detValido = true;
+    }
+    return det;
 }
 //******************************************************************************
 Matriz Matriz::Cofactores() const
@@ -328,6 +472,11 @@ Matriz Matriz::Cofactores() const
 Matriz Matriz::Inversa() const
 {
     if(n!=m) throw "Dimensiones incorrectas para el la matriz inversa";
+    if (usarCache) {
+        const Matriz *guardada = LeerCache(inversaCache);
+        if (guardada != nullptr) return *guardada;
+    }
+
     Matriz inversa(n, n);
     tipo determinante = this->Determinante();
 
@@ -344,10 +493,522 @@ Matriz Matriz::Inversa() const
         }
     }
 
+    if (usarCache) GuardarCache(inversaCache, inversa);
     return inversa;
 
 }
 
+//******************************************************************************
+
+/* NCLEOS VECTORIALES */
+
+// El tipo long double no tiene forma vectorial en x86, as que solo los ncleos en double que usa
+// Resolver() se compilan para varios conjuntos de instrucciones y se eligen en tiempo de ejecucin.
+
+//***********************************
+// y = y - ax
+static void RestarEscaladoBase(double *y, const double *x, double a, unsigned int n)
+{
+    for (unsigned int j = 0; j < n; ++j) y[j] -= a * x[j];
+}
+//***********************************
+static double ProductoPuntoBase(const double *x, const double *y, unsigned int n)
+{
+    double suma = 0;
+    for (unsigned int j = 0; j < n; ++j) suma += x[j] * y[j];
+    return suma;
+}
+
+#ifdef MATRIZ_X86
+//***********************************
+__attribute__((target("avx2,fma")))
+static void RestarEscaladoAvx2(double *y, const double *x, double a, unsigned int n)
+{
+    const __m256d va = _mm256_set1_pd(a);
+    unsigned int j = 0;
+    for (; j + 4 <= n; j += 4) {
+        __m256d vy = _mm256_loadu_pd(y + j);
+        vy = _mm256_fnmadd_pd(va, _mm256_loadu_pd(x + j), vy);
+        _mm256_storeu_pd(y + j, vy);
+    }
+    for (; j < n; ++j) y[j] -= a * x[j];
+}
+//***********************************
+__attribute__((target("avx2,fma")))
+static double ProductoPuntoAvx2(const double *x, const double *y, unsigned int n)
+{
+    __m256d vs = _mm256_setzero_pd();
+    unsigned int j = 0;
+    for (; j + 4 <= n; j += 4) {
+        vs = _mm256_fmadd_pd(_mm256_loadu_pd(x + j), _mm256_loadu_pd(y + j), vs);
+    }
+    double parcial[4];
+    _mm256_storeu_pd(parcial, vs);
+    double suma = (parcial[0] + parcial[1]) + (parcial[2] + parcial[3]);
+    for (; j < n; ++j) suma += x[j] * y[j];
+    return suma;
+}
+//***********************************
+__attribute__((target("avx512f")))
+static void RestarEscaladoAvx512(double *y, const double *x, double a, unsigned int n)
+{
+    const __m512d va = _mm512_set1_pd(a);
+    unsigned int j = 0;
+    for (; j + 8 <= n; j += 8) {
+        __m512d vy = _mm512_loadu_pd(y + j);
+        vy = _mm512_fnmadd_pd(va, _mm512_loadu_pd(x + j), vy);
+        _mm512_storeu_pd(y + j, vy);
+    }
+    for (; j < n; ++j) y[j] -= a * x[j];
+}
+//***********************************
+__attribute__((target("avx512f")))
+static double ProductoPuntoAvx512(const double *x, const double *y, unsigned int n)
+{
+    __m512d vs = _mm512_setzero_pd();
+    unsigned int j = 0;
+    for (; j + 8 <= n; j += 8) {
+        vs = _mm512_fmadd_pd(_mm512_loadu_pd(x + j), _mm512_loadu_pd(y + j), vs);
+    }
+    double parcial[8];
+    _mm512_storeu_pd(parcial, vs);
+    double suma = ((parcial[0] + parcial[1]) + (parcial[2] + parcial[3]))
+                + ((parcial[4] + parcial[5]) + (parcial[6] + parcial[7]));
+    for (; j < n; ++j) suma += x[j] * y[j];
+    return suma;
+}
+#endif
+
+// Versiones de los ncleos elegidas para un nivel. Se copian por valor, as que cada rutina trabaja con
+// un juego coherente aunque otro hilo cambie el nivel con EstablecerNivelSimd().
+struct NucleosDouble {
+    Matriz::NivelSimd nivel;
+    void (*RestarEscalado)(double *, const double *, double, unsigned int);
+    double (*ProductoPunto)(const double *, const double *, unsigned int);
+};
+
+// Nivel forzado con EstablecerNivelSimd(); SIMD_AUTO indica que se usa el detectado
+static std::atomic<int> nivelForzado(Matriz::SIMD_AUTO);
+
+//***********************************
+// Indica si el procesador (y el sistema operativo) soportan el nivel indicado
+static bool SoportaNivelSimd(Matriz::NivelSimd nivel)
+{
+    switch (nivel) {
+    case Matriz::SIMD_AUTO:
+    case Matriz::SIMD_BASE:
+        return true;
+#ifdef MATRIZ_X86
+    case Matriz::SIMD_AVX2:
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    case Matriz::SIMD_AVX512:
+        return __builtin_cpu_supports("avx512f");
+#endif
+    default:
+        return false;
+    }
+}
+//***********************************
+// Resuelve SIMD_AUTO al mejor nivel disponible y devuelve los ncleos para ese nivel
+static NucleosDouble SeleccionarNucleos(Matriz::NivelSimd nivel)
+{
+    if (nivel == Matriz::SIMD_AUTO) {
+        nivel = Matriz::SIMD_BASE;
+        if (SoportaNivelSimd(Matriz::SIMD_AVX2)) nivel = Matriz::SIMD_AVX2;
+        if (SoportaNivelSimd(Matriz::SIMD_AVX512)) nivel = Matriz::SIMD_AVX512;
+    }
+
+    NucleosDouble nucleos = { nivel, RestarEscaladoBase, ProductoPuntoBase };
+#ifdef MATRIZ_X86
+    if (nivel == Matriz::SIMD_AVX2) {
+        nucleos.RestarEscalado = RestarEscaladoAvx2;
+        nucleos.ProductoPunto = ProductoPuntoAvx2;
+    } else if (nivel == Matriz::SIMD_AVX512) {
+        nucleos.RestarEscalado = RestarEscaladoAvx512;
+        nucleos.ProductoPunto = ProductoPuntoAvx512;
+    }
+#endif
+    return nucleos;
+}
+//***********************************
+// Ncleos en uso. La deteccin se hace una sola vez; C++11 garantiza que la inicializacin de la variable
+// esttica local es segura entre hilos.
+static NucleosDouble NucleosActivos()
+{
+    static const NucleosDouble detectados = SeleccionarNucleos(Matriz::SIMD_AUTO);
+
+    const Matriz::NivelSimd nivel = static_cast<Matriz::NivelSimd>(nivelForzado.load());
+    return (nivel == Matriz::SIMD_AUTO) ? detectados : SeleccionarNucleos(nivel);
+}
+//***********************************
+void Matriz::EstablecerNivelSimd(NivelSimd nivel)
+{
+    if (!SoportaNivelSimd(nivel)) throw "El procesador no soporta el nivel SIMD solicitado";
+    nivelForzado.store(nivel);
+}
+//***********************************
+Matriz::NivelSimd Matriz::ObtenerNivelSimd()
+{
+    return NucleosActivos().nivel;
+}
+
+//******************************************************************************
+
+/* SISTEMAS DE ECUACIONES */
+
+// Nmero mximo de pasos de refinamiento iterativo por columna
+static const int MAX_REFINAMIENTO = 10;
+// Error relativo mximo, estimado con la ltima correccin, que se acepta si el refinamiento no converge
+static const tipo TOLERANCIA_REFINAMIENTO = 1e-6L;
+
+//***********************************
+// Resuelve LUx = Px en double sobre el vector x
+static void SustituirLU(const double *lu, const unsigned int *piv, unsigned int n, double *x)
+{
+    const NucleosDouble nucleos = NucleosActivos();
+    for (unsigned int i = 0; i < n; ++i) {
+        double t = x[piv[i]];
+        x[piv[i]] = x[i];
+        x[i] = t;
+    }
+    for (unsigned int i = 1; i < n; ++i) {
+        const double *fila = lu + i * n;
+        x[i] -= nucleos.ProductoPunto(fila, x, i);
+    }
+    for (unsigned int i = n; i-- > 0; ) {
+        const double *fila = lu + i * n;
+        x[i] = (x[i] - nucleos.ProductoPunto(fila + i + 1, x + i + 1, n - i - 1)) / fila[i];
+    }
+}
+//***********************************
+// Factoriza en double la matriz equilibrada 2^-escala[i]  A(i,j)  2^-escala[n+j]. Las escalas son potencias de
+// dos, por lo que son exactas y llevan a double matrices cuyos elementos exceden su rango de exponentes.
+void Matriz::FactorizarLU(double *lu, unsigned int *piv, int *escala) const
+{
+    const NucleosDouble nucleos = NucleosActivos();
+    int *escalaRen = escala, *escalaCol = escala + n;
+    for (unsigned int i = 0; i < n; ++i) {
+        tipo maximo = 0;
+        for (unsigned int j = 0; j < n; ++j) maximo = std::max(maximo, std::fabs(componente[i][j]));
+        if (maximo == 0) throw "La matriz es singular";
+        std::frexp(maximo, &escalaRen[i]);
+    }
+    for (unsigned int j = 0; j < n; ++j) {
+        tipo maximo = 0;
+        for (unsigned int i = 0; i < n; ++i) {
+            maximo = std::max(maximo, std::fabs(std::ldexp(componente[i][j], -escalaRen[i])));
+        }
+        if (maximo == 0) throw "La matriz es singular";
+        std::frexp(maximo, &escalaCol[j]);
+    }
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            lu[i * n + j] = static_cast<double>(std::ldexp(componente[i][j], -escalaRen[i] - escalaCol[j]));
+        }
+    }
+
+    for (unsigned int k = 0; k < n; ++k) {
+        // Pivoteo parcial: se elige el mayor elemento de la columna k
+        unsigned int p = k;
+        for (unsigned int i = k + 1; i < n; ++i) {
+            if (std::fabs(lu[i * n + k]) > std::fabs(lu[p * n + k])) p = i;
+        }
+        piv[k] = p;
+        if (lu[p * n + k] == 0.0) throw "La matriz es singular";
+        if (p != k) {
+            for (unsigned int j = 0; j < n; ++j) std::swap(lu[k * n + j], lu[p * n + j]);
+        }
+
+        const double *filaK = lu + k * n;
+        for (unsigned int i = k + 1; i < n; ++i) {
+            double *filaI = lu + i * n;
+            double factor = filaI[k] / filaK[k];
+            filaI[k] = factor;
+            nucleos.RestarEscalado(filaI + k + 1, filaK + k + 1, factor, n - k - 1);
+        }
+    }
+}
+//***********************************
+Matriz Matriz::Resolver(const Matriz &b) const
+{
+    if (n != m) throw "Dimensiones incorrectas para resolver el sistema";
+    if (b.m != n) throw "Dimensiones incompatibles para resolver el sistema";
+
+    Matriz x(b.m, b.n);
+    std::vector<double> lu, d;
+    std::vector<unsigned int> piv;
+    std::vector<int> esc;
+    std::vector<tipo> r;
+    const double *factores;
+    const unsigned int *pivotes;
+    const int *escala;
+    {
+        std::lock_guard<std::mutex> bloqueo(cerrojoCache);
+        factores = luCache;
+        pivotes = pivCache;
+        escala = escalaCache;
+    }
+    try {
+        d.resize(n);
+        r.resize(n);
+        if (factores == nullptr) {
+            lu.resize(n * n);
+            piv.resize(n);
+            esc.resize(2 * n);
+            FactorizarLU(lu.data(), piv.data(), esc.data());
+            factores = lu.data();
+            pivotes = piv.data();
+            escala = esc.data();
+        }
+    } catch (std::bad_alloc &) {
+        throw "No es posible construir una Matriz";
+    }
+
+    if (usarCache && !lu.empty()) {
+        // Se copia fuera del cerrojo y se publica solo si ningn otro hilo guard la factorizacin antes
+        double *nuevoLu = nullptr;
+        unsigned int *nuevoPiv = nullptr;
+        int *nuevaEscala = nullptr;
+        try {
+            nuevoLu = new double[n * n];
+            nuevoPiv = new unsigned int[n];
+            nuevaEscala = new int[2 * n];
+            std::copy(lu.begin(), lu.end(), nuevoLu);
+            std::copy(piv.begin(), piv.end(), nuevoPiv);
+            std::copy(esc.begin(), esc.end(), nuevaEscala);
+            std::lock_guard<std::mutex> bloqueo(cerrojoCache);
+            if (luCache == nullptr) {
+                luCache = nuevoLu;
+                pivCache = nuevoPiv;
+                escalaCache = nuevaEscala;
+                nuevoLu = nullptr;
+                nuevoPiv = nullptr;
+                nuevaEscala = nullptr;
+            }
+        } catch (std::bad_alloc &) {
+            // Sin memoria para la cach, solo se pierde el atajo
+        }
+        delete[] nuevoLu;
+        delete[] nuevoPiv;
+        delete[] nuevaEscala;
+    }
+    const int *escalaRen = escala, *escalaCol = escala + n;
+
+    for (unsigned int j = 0; j < b.n; ++j) {
+        for (unsigned int i = 0; i < n; ++i) r[i] = b.componente[i][j];
+
+        tipo normaAnterior = 0, normaX = 0, error = 0;
+        bool convergio = false;
+        for (int iter = 0; iter < MAX_REFINAMIENTO; ++iter) {
+            // Correccin en double a partir del residuo en precisin tipo. El residuo se equilibra con las
+            // escalas de rengln y con una potencia de dos propia, para que quepa en double sin perder rango.
+            tipo maximoR = 0;
+            for (unsigned int i = 0; i < n; ++i) {
+                r[i] = std::ldexp(r[i], -escalaRen[i]);
+                maximoR = std::max(maximoR, std::fabs(r[i]));
+            }
+            if (maximoR == 0) {
+                convergio = true;
+                break;
+            }
+            int escalaR;
+            std::frexp(maximoR, &escalaR);
+            for (unsigned int i = 0; i < n; ++i) d[i] = static_cast<double>(std::ldexp(r[i], -escalaR));
+            SustituirLU(factores, pivotes, n, d.data());
+
+            tipo normaD = 0;
+            for (unsigned int i = 0; i < n; ++i) {
+                r[i] = std::ldexp(static_cast<tipo>(d[i]), escalaR - escalaCol[i]);
+                normaD = std::max(normaD, std::fabs(r[i]));
+            }
+            // Si la correccin deja de reducirse se conserva la mejor solucin y la correccin estima su error
+            error = normaD;
+            if (!std::isfinite(normaD) || (iter > 0 && normaD >= normaAnterior)) break;
+
+            normaX = 0;
+            for (unsigned int i = 0; i < n; ++i) {
+                x.componente[i][j] += r[i];
+                normaX = std::max(normaX, std::fabs(x.componente[i][j]));
+            }
+            if (normaD <= LDBL_EPSILON * normaX) {
+                convergio = true;
+                break;
+            }
+            normaAnterior = normaD;
+
+            // Residuo r = b - Ax en precisin tipo
+            for (unsigned int i = 0; i < n; ++i) {
+                tipo suma = b.componente[i][j];
+                for (unsigned int k = 0; k < n; ++k) suma -= componente[i][k] * x.componente[k][j];
+                r[i] = suma;
+            }
+        }
+        if (!convergio && !(error <= TOLERANCIA_REFINAMIENTO * normaX))
+            throw "La matriz est mal condicionada para resolver el sistema";
+    }
+
+    return x;
+}
+//***********************************
+Matriz Matriz::InversaRefinada() const
+{
+    if(n!=m) throw "Dimensiones incorrectas para el la matriz inversa";
+    Matriz identidad(n, n);
+    for (unsigned int i = 0; i < n; ++i) identidad.componente[i][i] = 1;
+
+    return Resolver(identidad);
+}
+
+//******************************************************************************
+
+/* POTENCIAS */
+
+// Grado de la aproximacin de Pad usada por Exponencial()
+static const int GRADO_PADE = 8;
+
+//***********************************
+Matriz Matriz::Potencia(int k) const
+{
+    if(n!=m) throw "Dimensiones incorrectas para la potencia";
+
+    Matriz resultado(n, n), temporal(n, n);
+    for (unsigned int i = 0; i < n; ++i) resultado.componente[i][i] = 1;
+
+    Matriz base = (k < 0) ? InversaRefinada() : *this;
+    base.usarCache = false;
+    unsigned int e = (k < 0) ? 0u - static_cast<unsigned int>(k) : static_cast<unsigned int>(k);
+
+    // Exponenciacin binaria; temporal se reutiliza como espacio de trabajo en cada producto
+    while (e > 0) {
+        if (e & 1) {
+            Multiplicar(resultado, base, temporal);
+            resultado.Intercambiar(temporal);
+        }
+        e >>= 1;
+        if (e > 0) {
+            Multiplicar(base, base, temporal);
+            base.Intercambiar(temporal);
+        }
+    }
+
+    return resultado;
+}
+//***********************************
+Matriz Matriz::Exponencial() const
+{
+    if(n!=m) throw "Dimensiones incorrectas para la exponencial";
+
+    // Escalamiento: se divide entre 2^s para que la norma infinito quede en 1/2 o menos
+    tipo norma = 0;
+    for (unsigned int i = 0; i < n; ++i) {
+        tipo suma = 0;
+        for (unsigned int j = 0; j < n; ++j) suma += std::fabs(componente[i][j]);
+        if (!std::isfinite(suma)) throw "La matriz tiene elementos infinitos o indefinidos";
+        norma = std::max(norma, suma);
+    }
+    int s = 0;
+    if (norma > 0.5) {
+        s = std::max(0, static_cast<int>(std::floor(std::log2(norma))) + 2);
+    }
+    const tipo escala = std::ldexp(static_cast<tipo>(1), -s);
+
+    Matriz a(n, n), x(n, n), temporal(n, n), numerador(n, n), denominador(n, n);
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            a.componente[i][j] = componente[i][j] * escala;
+            x.componente[i][j] = a.componente[i][j];
+        }
+    }
+
+    // Aproximacin de Pad: exp(A) ~ D(A)^-1  N(A)
+    tipo c = 0.5;
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            numerador.componente[i][j] = c * a.componente[i][j];
+            denominador.componente[i][j] = -c * a.componente[i][j];
+        }
+        numerador.componente[i][i] += 1;
+        denominador.componente[i][i] += 1;
+    }
+    for (int k = 2; k <= GRADO_PADE; ++k) {
+        c = c * (GRADO_PADE - k + 1) / (k * (2 * GRADO_PADE - k + 1));
+        Multiplicar(a, x, temporal);
+        x.Intercambiar(temporal);
+        const tipo signo = (k % 2 == 0) ? 1 : -1;
+        for (unsigned int i = 0; i < n; ++i) {
+            for (unsigned int j = 0; j < n; ++j) {
+                numerador.componente[i][j] += c * x.componente[i][j];
+                denominador.componente[i][j] += signo * c * x.componente[i][j];
+            }
+        }
+    }
+
+    Matriz resultado = denominador.Resolver(numerador);
+
+    // Elevacin al cuadrado para deshacer el escalamiento
+    for (int k = 0; k < s; ++k) {
+        Multiplicar(resultado, resultado, temporal);
+        resultado.Intercambiar(temporal);
+    }
+
+    return resultado;
+}
+
+//******************************************************************************
+
+/* RESULTADOS EN CACH */
+//***********************************
+void Matriz::ActivarCache(bool activar)
+{
+    if (!activar) InvalidarCache();
+    usarCache = activar;
+}
+//***********************************
+bool Matriz::CacheActiva() const
+{
+    return usarCache;
+}
+//***********************************
+// Lee bajo el cerrojo un resultado guardado. Lo guardado no cambia mientras la matriz solo se use como
+// const, as que el llamador puede copiarlo ya sin el cerrojo.
+const Matriz *Matriz::LeerCache(Matriz *const &campo) const
+{
+    std::lock_guard<std::mutex> bloqueo(cerrojoCache);
+    return campo;
+}
+//***********************************
+// Guarda una copia de valor si ningn otro hilo guard el resultado antes
+void Matriz::GuardarCache(Matriz *&campo, const Matriz &valor) const
+{
+    Matriz *copia;
+    try {
+        copia = new Matriz(valor);
+    } catch (...) {
+        return; // Sin memoria para la cach, solo se pierde el atajo
+    }
+    std::lock_guard<std::mutex> bloqueo(cerrojoCache);
+    if (campo == nullptr) {
+        campo = copia;
+    } else {
+        delete copia;
+    }
+}
+//***********************************
+void Matriz::InvalidarCache()
+{
+    detValido = false;
+    delete inversaCache;
+    inversaCache = nullptr;
+    delete transpuestaCache;
+    transpuestaCache = nullptr;
+    delete[] luCache;
+    luCache = nullptr;
+    delete[] pivCache;
+    pivCache = nullptr;
+    delete[] escalaCache;
+    escalaCache = nullptr;
+}
+
 
 /* FUNCIONES EXTERNAS*/
 //*****************************************************************
@@ -382,6 +1043,7 @@ std::ostream & operator<<(std::ostream &out,const Matriz &v)
 //**************************************************************
 std::istream & operator>>(std::istream &in,Matriz &v)
 {
+    v.InvalidarCache();
     for(unsigned int i = 0 ; i < v.m ; ++i){
         for(unsigned int j = 0; j<v.n; ++j){
                     in >>v.componente[i][j];
@@ -9,6 +9,7 @@
 #define MATRIZ_HPP_INCLUDED
 
 #include <iostream>
+#include <mutex>
 
 /** \class Matriz
  *
@@ -193,6 +194,11 @@ class Matriz {
      */
     friend Matriz operator*(double escalar, const Matriz &v);
 
+    // Las matrices estructuradas operan directamente sobre los elementos de la matriz densa
+    friend class MatrizDiagonal;
+    friend class MatrizTriangular;
+    friend class MatrizTridiagonal;
+
 
 public:
     /** \brief Constructor.
@@ -243,6 +249,11 @@ public:
     void Imprimir() const;
 
     /** \brief Redimensiona una matriz.
+     *
+     * Si las nuevas dimensiones caben en la capacidad reservada, la matriz se redimensiona en su lugar sin
+     * reservar memoria; en caso contrario cada dimensin que no cabe crece al menos al doble de su capacidad,
+     * de modo que una serie de crecimientos pequeos no reubique la matriz en cada llamada. Los elementos
+     * nuevos se inicializan con ceros.
      *
      * \param nuevo_m Nuevo nmero de filas.
      * \param nuevo_n Nuevo nmero de columnas.
@@ -267,6 +278,67 @@ public:
      */
     int ObtenerNumCol() const;
 
+    // CAPACIDAD
+
+    /** \brief Obtiene el nmero de filas para las que hay memoria reservada.
+     *
+     * \return La capacidad de filas de la matriz.
+     *
+     */
+    int ObtenerCapRen() const;
+
+    /** \brief Obtiene el nmero de columnas para las que hay memoria reservada.
+     *
+     * \return La capacidad de columnas de la matriz.
+     *
+     */
+    int ObtenerCapCol() const;
+
+    /** \brief Reserva memoria para que la matriz pueda crecer sin volver a reservarla.
+     *
+     * No cambia las dimensiones de la matriz ni reduce la capacidad actual.
+     *
+     * \param renglones Capacidad mnima de filas.
+     * \param columnas Capacidad mnima de columnas.
+     *
+     * \pre \b renglones y \b columnas deben ser nmeros positivos.
+     *
+     * \exception const <b>char *</b> La memoria no puede ser reservada o las dimensiones no son positivas.
+     */
+    void Reservar(unsigned int renglones, unsigned int columnas);
+
+    /** \brief Agrega un rengln al final de la matriz.
+     *
+     * La capacidad de filas se duplica cuando se agota, por lo que agregar renglones tiene costo amortizado
+     * proporcional al tamao del rengln.
+     *
+     * \param renglon Matriz de 1 x (columnas de esta matriz) con los elementos del rengln.
+     *
+     * \pre \b renglon debe tener una fila y tantas columnas como la matriz.
+     *
+     * \exception const <b>char *</b> El rengln tiene dimensiones incompatibles o la matriz no puede crecer.
+     */
+    void AgregarRenglon(const Matriz &renglon);
+
+    /** \brief Agrega una columna al final de la matriz.
+     *
+     * La capacidad de columnas se duplica cuando se agota, por lo que agregar columnas tiene costo amortizado
+     * proporcional al tamao de la columna.
+     *
+     * \param columna Matriz de (filas de esta matriz) x 1 con los elementos de la columna.
+     *
+     * \pre \b columna debe tener una columna y tantas filas como la matriz.
+     *
+     * \exception const <b>char *</b> La columna tiene dimensiones incompatibles o la matriz no puede crecer.
+     */
+    void AgregarColumna(const Matriz &columna);
+
+    /** \brief Libera la memoria reservada que excede las dimensiones actuales de la matriz.
+     *
+     * \exception const <b>char *</b> La matriz no puede ser reubicada.
+     */
+    void AjustarCapacidad();
+
     // OPERACIONES
 
     /** \brief Operador para sumar dos matrices.
@@ -311,6 +383,19 @@ public:
      */
     Matriz operator*(double escalar) const;
 
+    /** \brief Calcula el producto matricial de dos matrices.
+     *
+     * A diferencia del operador *, que multiplica elemento a elemento, realiza el producto fila por columna.
+     *
+     * \param v La matriz por la que se multiplica por la derecha.
+     * \return La matriz resultante del producto, de dimensiones (filas de esta matriz) x (columnas de \b v).
+     *
+     * \pre El nmero de columnas de esta matriz debe ser igual al nmero de filas de \b v.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz Producto(const Matriz &v) const;
+
     /** \brief Calcula la transpuesta de una matriz.
      *
      * \return La matriz transpuesta.
@@ -342,11 +427,145 @@ public:
      */
     Matriz Inversa() const;
 
+    // SISTEMAS DE ECUACIONES
+
+    /** \brief Resuelve el sistema de ecuaciones lineales AX = B, donde A es esta matriz.
+     *
+     * La factorizacin LU con pivoteo parcial se calcula en precisin double y la solucin se mejora con
+     * refinamiento iterativo, calculando los residuos en precisin tipo. Para sistemas bien condicionados el
+     * resultado tiene la exactitud de tipo con el costo de una factorizacin en double. Antes de convertir a
+     * double, los renglones y columnas se escalan por potencias de dos, as que los elementos fuera del rango
+     * de double no provocan desbordamientos ni falsas singularidades.
+     *
+     * \param b La matriz de trminos independientes; cada columna es un lado derecho.
+     * \return La matriz solucin X, de las mismas dimensiones que \b b.
+     *
+     * \pre La matriz debe ser cuadrada y \b b debe tener tantas filas como ella.
+     *
+     * \exception const <b>char *</b> Las dimensiones son incompatibles, la matriz es singular, est tan mal condicionada
+     * que el refinamiento no alcanza seis cifras correctas o la matriz solucin no puede ser creada.
+     */
+    Matriz Resolver(const Matriz &b) const;
+
+    /** \brief Calcula la matriz inversa mediante Resolver().
+     *
+     * Equivale a resolver AX = I con factorizacin en double y refinamiento iterativo en precisin tipo.
+     *
+     * \return La matriz inversa.
+     *
+     * \exception const <b>char *</b> La matriz no es cuadrada, singular, est mal condicionada o la matriz inversa no puede ser
+     * calculada.
+     */
+    Matriz InversaRefinada() const;
+
+    // POTENCIAS
+
+    /** \brief Eleva una matriz a una potencia entera.
+     *
+     * Usa exponenciacin binaria, por lo que realiza O(log k) productos matriciales. Una potencia negativa se
+     * calcula como la potencia de la inversa obtenida con InversaRefinada().
+     *
+     * \param k El exponente.
+     * \return La matriz elevada a la potencia \b k; la identidad si \b k es cero.
+     *
+     * \pre La matriz debe ser cuadrada y no singular si \b k es negativo.
+     *
+     * \exception const <b>char *</b> La matriz no es cuadrada, es singular o mal condicionada con \b k negativo, o la matriz
+     * resultante no puede ser creada.
+     */
+    Matriz Potencia(int k) const;
+
+    /** \brief Calcula la exponencial de una matriz.
+     *
+     * Usa escalamiento y elevacin al cuadrado con una aproximacin de Pad de grado 8, suficiente para la
+     * precisin de tipo una vez que la matriz escalada tiene norma menor o igual a 1/2.
+     *
+     * \return La matriz exponencial.
+     *
+     * \pre La matriz debe ser cuadrada.
+     *
+     * \exception const <b>char *</b> La matriz no es cuadrada, tiene elementos infinitos o NaN, o la matriz resultante no puede ser creada.
+     */
+    Matriz Exponencial() const;
+
+    // NCLEOS VECTORIALES
+
+    /** \brief Conjuntos de instrucciones con los que se pueden ejecutar los ncleos en double de Resolver().
+     *
+     */
+    enum NivelSimd {
+        SIMD_AUTO,      ///< Se elige el mejor nivel que soporte el procesador.
+        SIMD_BASE,      ///< Cdigo escalar, disponible en cualquier procesador.
+        SIMD_AVX2,      ///< AVX2 con FMA.
+        SIMD_AVX512     ///< AVX-512F.
+    };
+
+    /** \brief Fija el conjunto de instrucciones de los ncleos en double.
+     *
+     * Por omisin el nivel se detecta en tiempo de ejecucin con CPUID. Esta funcin permite forzar un nivel
+     * inferior, por ejemplo para probar todos los ncleos en un mismo equipo; SIMD_AUTO restablece la deteccin.
+     * El cambio es atmico y puede hacerse mientras otros hilos resuelven sistemas; cada factorizacin o
+     * sustitucin en curso termina con el nivel que tena al comenzar.
+     *
+     * \param nivel El nivel a usar.
+     *
+     * \exception const <b>char *</b> El procesador no soporta el nivel solicitado.
+     */
+    static void EstablecerNivelSimd(NivelSimd nivel);
+
+    /** \brief Obtiene el conjunto de instrucciones con el que se ejecutan los ncleos en double.
+     *
+     * \return El nivel en uso; nunca es SIMD_AUTO.
+     *
+     */
+    static NivelSimd ObtenerNivelSimd();
+
+    // RESULTADOS EN CACH
+
+    /** \brief Activa o desactiva la cach de resultados derivados.
+     *
+     * Con la cach activa, el determinante, la inversa, la transpuesta y la factorizacin LU usada por Resolver()
+     * se calculan una sola vez y se reutilizan
+     * mientras la matriz no sea modificada. La cach se invalida al capturar, redimensionar o asignar la matriz.
+     * Por omisin la cach est desactivada; las copias, por construccin o por asignacin, heredan el estado
+     * de la matriz original. La cach est protegida por un cerrojo, de modo que una matriz con cach puede
+     * consultarse desde varios hilos a la vez mientras ninguno la modifique.
+     *
+     * \param activar <b>true</b> para activar la cach, <b>false</b> para desactivarla y liberar su contenido.
+     *
+     */
+    void ActivarCache(bool activar = true);
+
+    /** \brief Indica si la cach de resultados derivados est activa.
+     *
+     * \return <b>true</b> si la cach est activa, <b>false</b> en caso contrario.
+     *
+     */
+    bool CacheActiva() const;
+
 
 private:
     unsigned int m, n;
+    unsigned int capM, capN;
     tipo **componente = NULL;
     void EstablecerDim(int m, int n);
+    void Reubicar(unsigned int nueva_capM, unsigned int nueva_capN);
+
+    bool usarCache = false;
+    mutable bool detValido = false;
+    mutable tipo detCache = 0;
+    mutable Matriz *inversaCache = nullptr;
+    mutable Matriz *transpuestaCache = nullptr;
+    mutable std::mutex cerrojoCache;
+    mutable double *luCache = nullptr;
+    mutable unsigned int *pivCache = nullptr;
+    mutable int *escalaCache = nullptr;
+    void InvalidarCache();
+    const Matriz *LeerCache(Matriz *const &campo) const;
+    void GuardarCache(Matriz *&campo, const Matriz &valor) const;
+    void FactorizarLU(double *lu, unsigned int *piv, int *escala) const;
+    static void Multiplicar(const Matriz &a, const Matriz &b, Matriz &c);
+    void Intercambiar(Matriz &v);
 };
 
 #endif // MATRIZ_HPP_INCLUDED
@@ -0,0 +1,167 @@
+#include "MatrizDiagonal.hpp"
+
+
+//***************************************************
+void MatrizDiagonal::EstablecerDim(int n)
+{
+    if (n < 1)throw "Valor fuera de rango";
+    this->n = n;
+}
+
+//***********************************
+//Constructor
+MatrizDiagonal::MatrizDiagonal(int n) {
+    EstablecerDim(n);
+    try {
+        diagonal = new tipo[n];
+        for (int i = 0; i < n; ++i) diagonal[i] = 0;
+    } catch(std::bad_alloc &) {
+        throw "No es posible construir una MatrizDiagonal";
+    }
+}
+
+//***********************************
+// Constructor de copia
+MatrizDiagonal::MatrizDiagonal(const MatrizDiagonal &v) : n(v.n), diagonal(nullptr) {
+    try {
+        diagonal = new tipo[n];
+        for (unsigned int i = 0; i < n; ++i) diagonal[i] = v.diagonal[i];
+    } catch(std::bad_alloc &) {
+        throw "No es posible construir una MatrizDiagonal";
+    }
+}
+//***********************************
+// Constructor a partir de una matriz densa
+MatrizDiagonal::MatrizDiagonal(const Matriz &v) : MatrizDiagonal(v.ObtenerNumRen()) {
+    if (v.m != v.n) throw "La matriz no es cuadrada";
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            if (i != j && v.componente[i][j] != 0) throw "La matriz no es diagonal";
+        }
+        diagonal[i] = v.componente[i][i];
+    }
+}
+//***********************************
+// Operador de asignacin
+MatrizDiagonal & MatrizDiagonal::operator=(const MatrizDiagonal &v) {
+    if (this == &v) return *this;
+    try {
+        if (n != v.n) {
+            tipo *nueva = new tipo[v.n];
+            delete[] diagonal;
+            diagonal = nueva;
+            n = v.n;
+        }
+        for (unsigned int i = 0; i < n; ++i) diagonal[i] = v.diagonal[i];
+    } catch (std::bad_alloc &) {
+        throw "No es posible construir una MatrizDiagonal";
+    }
+
+    return *this;
+}
+//***********************************
+// Destructor
+MatrizDiagonal::~MatrizDiagonal() {
+        delete[] diagonal;
+        diagonal = nullptr;
+}
+//***********************************
+int MatrizDiagonal::ObtenerDim() const
+{
+    return n;
+}
+
+//***************************************************************************
+
+/* OPERACIONES */
+//***********************************
+tipo MatrizDiagonal::Determinante() const
+{
+    tipo det = 1;
+    for (unsigned int i = 0; i < n; ++i) det *= diagonal[i];
+    return det;
+}
+//***********************************
+MatrizDiagonal MatrizDiagonal::Inversa() const
+{
+    MatrizDiagonal inversa(n);
+    for (unsigned int i = 0; i < n; ++i) {
+        if (diagonal[i] == 0) throw "No existe la inversa de esta matriz";
+        inversa.diagonal[i] = 1 / diagonal[i];
+    }
+    return inversa;
+}
+//***********************************
+MatrizDiagonal MatrizDiagonal::Producto(const MatrizDiagonal &v) const
+{
+    if (n != v.n)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    MatrizDiagonal s(n);
+    for (unsigned int i = 0; i < n; ++i) s.diagonal[i] = diagonal[i] * v.diagonal[i];
+    return s;
+}
+//***********************************
+Matriz MatrizDiagonal::Producto(const Matriz &v) const
+{
+    if (n != v.m)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    Matriz s(v.m, v.n);
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < v.n; ++j) {
+            s.componente[i][j] = diagonal[i] * v.componente[i][j];
+        }
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizDiagonal::ProductoPorIzquierda(const Matriz &v) const
+{
+    if (v.n != n)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    Matriz s(v.m, v.n);
+    for (unsigned int i = 0; i < v.m; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            s.componente[i][j] = v.componente[i][j] * diagonal[j];
+        }
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizDiagonal::Resolver(const Matriz &b) const
+{
+    if (n != b.m)
+        throw "Dimensiones incompatibles para resolver el sistema";
+
+    Matriz x(b.m, b.n);
+    for (unsigned int i = 0; i < n; ++i) {
+        if (diagonal[i] == 0) throw "La matriz es singular";
+        for (unsigned int j = 0; j < b.n; ++j) {
+            x.componente[i][j] = b.componente[i][j] / diagonal[i];
+        }
+    }
+    return x;
+}
+//***********************************
+Matriz MatrizDiagonal::ADensa() const
+{
+    Matriz s(n, n);
+    for (unsigned int i = 0; i < n; ++i) s.componente[i][i] = diagonal[i];
+    return s;
+}
+
+
+/* FUNCIONES EXTERNAS*/
+//*****************************************************************
+std::ostream & operator<<(std::ostream &out, const MatrizDiagonal &v)
+{
+    return out << v.ADensa();
+}
+//**************************************************************
+std::istream & operator>>(std::istream &in, MatrizDiagonal &v)
+{
+    for (unsigned int i = 0; i < v.n; ++i) in >> v.diagonal[i];
+    return in;
+}
@@ -0,0 +1,172 @@
+/**
+ * \file MatrizDiagonal.hpp
+ * \brief Implementaci&oacute;n de una matriz diagonal con almacenamiento compacto
+ */
+
+#ifndef MATRIZDIAGONAL_HPP_INCLUDED
+#define MATRIZDIAGONAL_HPP_INCLUDED
+
+#include <iostream>
+#include "Matriz.hpp"
+
+/** \class MatrizDiagonal
+ *
+ * Matriz cuadrada cuyos nicos elementos distintos de cero estn en la diagonal principal. Solo se almacenan
+ * los n elementos de la diagonal, por lo que el determinante, la inversa, la solucin de sistemas y el
+ * producto con una matriz densa cuestan O(n) por columna en lugar de O(n^2) u O(n^3).
+ *
+ * Ejemplo de uso:
+ * \code
+    MatrizDiagonal d(3);
+    Matriz b(3, 1);
+    cin >> d;   // Captura los 3 elementos de la diagonal
+    cin >> b;
+    Matriz x = d.Resolver(b);
+    cout << d.Determinante() << endl << x << d.ADensa();
+ * \endcode
+ */
+class MatrizDiagonal {
+    /** \brief Funcin amiga para la sobrecarga del operador de insercin.
+     *
+     * Imprime la matriz en su forma densa.
+     *
+     * \param out El flujo de salida.
+     * \param v La matriz a imprimir.
+     * \return El flujo de salida. Permite la aplicacin en cascada del operador.
+     *
+     */
+    friend std::ostream &operator<<(std::ostream &out, const MatrizDiagonal &v);
+
+    /** \brief Funcin amiga para la sobrecarga del operador de extraccin.
+     *
+     * Captura los elementos de la diagonal principal, en orden.
+     *
+     * \param in El flujo de entrada.
+     * \param v La matriz a capturar.
+     * \return El flujo de entrada. Permite la aplicacin en cascada del operador.
+     *
+     */
+    friend std::istream &operator>>(std::istream &in, MatrizDiagonal &v);
+
+public:
+    /** \brief Constructor. Crea una matriz diagonal de n x n con ceros.
+     *
+     * \param n Nmero de filas y columnas de la matriz.
+     *
+     * \pre \b n debe ser un nmero positivo.
+     *
+     * \exception const <b>char *</b> La matriz no puede ser creada o la dimensin no es positiva.
+     */
+    explicit MatrizDiagonal(int n = 3);
+
+    /** \brief Constructor de copias.
+     *
+     * \param v La matriz a copiar.
+     *
+     * \exception const <b>char *</b> La matriz copia no puede ser creada.
+     */
+    MatrizDiagonal(const MatrizDiagonal &v);
+
+    /** \brief Constructor a partir de una matriz densa con estructura diagonal.
+     *
+     * \param v La matriz densa a convertir.
+     *
+     * \pre \b v debe ser cuadrada y tener ceros fuera de la diagonal principal.
+     *
+     * \exception const <b>char *</b> La matriz no es cuadrada, no tiene la estructura indicada o no puede ser creada.
+     */
+    explicit MatrizDiagonal(const Matriz &v);
+
+    /** \brief Operador de asignacin. Copia una matriz diagonal en otra.
+     *
+     * \param v La matriz a copiar.
+     * \return La matriz copia. Permite la aplicacin en cascada del operador.
+     *
+     * \exception const <b>char *</b> La matriz copia no puede ser creada.
+     */
+    MatrizDiagonal &operator=(const MatrizDiagonal &v);
+
+    /** \brief Destructor.
+     *
+     */
+    ~MatrizDiagonal();
+
+    /** \brief Obtiene el nmero de filas (y de columnas) de la matriz.
+     *
+     * \return La dimensin de la matriz.
+     *
+     */
+    int ObtenerDim() const;
+
+    /** \brief Calcula el determinante como el producto de la diagonal, en O(n).
+     *
+     * \return El determinante de la matriz.
+     *
+     */
+    tipo Determinante() const;
+
+    /** \brief Calcula la matriz inversa, que tambin es diagonal, en O(n).
+     *
+     * \return La matriz inversa.
+     *
+     * \exception const <b>char *</b> La matriz es singular o la matriz inversa no puede ser creada.
+     */
+    MatrizDiagonal Inversa() const;
+
+    /** \brief Calcula el producto de dos matrices diagonales en O(n).
+     *
+     * \param v La matriz diagonal por la que se multiplica.
+     * \return La matriz diagonal resultante.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    MatrizDiagonal Producto(const MatrizDiagonal &v) const;
+
+    /** \brief Calcula el producto matricial por una matriz densa, escalando sus filas.
+     *
+     * \param v La matriz densa por la que se multiplica por la derecha.
+     * \return La matriz densa resultante.
+     *
+     * \pre El nmero de filas de \b v debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz Producto(const Matriz &v) const;
+
+    /** \brief Calcula el producto matricial vD de una matriz densa por esta matriz, escalando sus columnas.
+     *
+     * \param v La matriz densa por la que se multiplica por la izquierda.
+     * \return La matriz densa resultante.
+     *
+     * \pre El nmero de columnas de \b v debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz ProductoPorIzquierda(const Matriz &v) const;
+
+    /** \brief Resuelve el sistema DX = B dividiendo cada fila de B entre el elemento de la diagonal.
+     *
+     * \param b La matriz de trminos independientes.
+     * \return La matriz solucin X.
+     *
+     * \pre El nmero de filas de \b b debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las dimensiones son incompatibles, la matriz es singular o la matriz solucin no puede ser creada.
+     */
+    Matriz Resolver(const Matriz &b) const;
+
+    /** \brief Construye la matriz densa equivalente.
+     *
+     * \return La matriz densa de n x n.
+     *
+     * \exception const <b>char *</b> La matriz densa no puede ser creada.
+     */
+    Matriz ADensa() const;
+
+private:
+    unsigned int n;
+    tipo *diagonal = NULL;
+    void EstablecerDim(int n);
+};
+
+#endif // MATRIZDIAGONAL_HPP_INCLUDED
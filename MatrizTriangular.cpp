@@ -0,0 +1,214 @@
+#include <algorithm>
+
+#include "MatrizTriangular.hpp"
+
+
+//***************************************************
+void MatrizTriangular::EstablecerDim(int n)
+{
+    if (n < 1)throw "Valor fuera de rango";
+    this->n = n;
+}
+//***************************************************
+// Primera columna almacenada del rengln i
+unsigned int MatrizTriangular::Inicio(unsigned int i) const
+{
+    return inferior ? 0 : i;
+}
+//***************************************************
+// Columna siguiente a la ltima almacenada del rengln i
+unsigned int MatrizTriangular::Fin(unsigned int i) const
+{
+    return inferior ? i + 1 : n;
+}
+//***************************************************
+// Reserva el tringulo de n(n+1)/2 elementos. Cada rengln apunta de modo que renglon[i][j] use
+// el ndice de columna j de la matriz densa; el apuntador nunca sale del bloque reservado.
+void MatrizTriangular::Construir()
+{
+    renglon = nullptr;
+    try {
+        renglon = new tipo*[n];
+        renglon[0] = new tipo[n * (n + 1) / 2];
+    } catch(std::bad_alloc &) {
+        delete[] renglon;
+        renglon = nullptr;
+        throw "No es posible construir una MatrizTriangular";
+    }
+    tipo *bloque = renglon[0];
+    for (unsigned int i = 0; i < n; ++i) {
+        renglon[i] = bloque - Inicio(i);
+        bloque += Fin(i) - Inicio(i);
+    }
+}
+
+//***********************************
+//Constructor
+MatrizTriangular::MatrizTriangular(int n, bool inferior) : inferior(inferior) {
+    EstablecerDim(n);
+    Construir();
+    for (unsigned int i = 0; i < this->n; ++i) {
+        for (unsigned int j = Inicio(i); j < Fin(i); ++j) renglon[i][j] = 0;
+    }
+}
+
+//***********************************
+// Constructor de copia
+MatrizTriangular::MatrizTriangular(const MatrizTriangular &v) : n(v.n), inferior(v.inferior) {
+    Construir();
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = Inicio(i); j < Fin(i); ++j) renglon[i][j] = v.renglon[i][j];
+    }
+}
+//***********************************
+// Constructor a partir de una matriz densa
+MatrizTriangular::MatrizTriangular(const Matriz &v, bool inferior) : MatrizTriangular(v.ObtenerNumRen(), inferior) {
+    if (v.m != v.n) throw "La matriz no es cuadrada";
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            if (j >= Inicio(i) && j < Fin(i)) {
+                renglon[i][j] = v.componente[i][j];
+            } else if (v.componente[i][j] != 0) {
+                throw "La matriz no es triangular";
+            }
+        }
+    }
+}
+//***********************************
+// Operador de asignacin
+MatrizTriangular & MatrizTriangular::operator=(const MatrizTriangular &v) {
+    if (this == &v) return *this;
+    if (n != v.n || inferior != v.inferior) {
+        // Se reserva en una copia temporal para que un fallo deje intacta esta matriz
+        MatrizTriangular temporal(v);
+        std::swap(n, temporal.n);
+        std::swap(inferior, temporal.inferior);
+        std::swap(renglon, temporal.renglon);
+        return *this;
+    }
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = Inicio(i); j < Fin(i); ++j) renglon[i][j] = v.renglon[i][j];
+    }
+
+    return *this;
+}
+//***********************************
+// Destructor
+MatrizTriangular::~MatrizTriangular() {
+        delete[] renglon[0];
+        delete[] renglon;
+        renglon = nullptr;
+}
+//***********************************
+int MatrizTriangular::ObtenerDim() const
+{
+    return n;
+}
+//***********************************
+bool MatrizTriangular::EsInferior() const
+{
+    return inferior;
+}
+
+//***************************************************************************
+
+/* OPERACIONES */
+//***********************************
+tipo MatrizTriangular::Determinante() const
+{
+    tipo det = 1;
+    for (unsigned int i = 0; i < n; ++i) det *= renglon[i][i];
+    return det;
+}
+//***********************************
+MatrizTriangular MatrizTriangular::Transpuesta() const
+{
+    MatrizTriangular s(n, !inferior);
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = Inicio(i); j < Fin(i); ++j) s.renglon[j][i] = renglon[i][j];
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizTriangular::Producto(const Matriz &v) const
+{
+    if (n != v.m)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    Matriz s(v.m, v.n);
+    for (unsigned int i = 0; i < n; ++i) {
+        tipo *filaS = s.componente[i];
+        for (unsigned int k = Inicio(i); k < Fin(i); ++k) {
+            const tipo tik = renglon[i][k];
+            const tipo *filaV = v.componente[k];
+            for (unsigned int j = 0; j < v.n; ++j) filaS[j] += tik * filaV[j];
+        }
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizTriangular::ProductoPorIzquierda(const Matriz &v) const
+{
+    if (v.n != n)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    Matriz s(v.m, v.n);
+    for (unsigned int i = 0; i < v.m; ++i) {
+        tipo *filaS = s.componente[i];
+        for (unsigned int k = 0; k < n; ++k) {
+            const tipo vik = v.componente[i][k];
+            for (unsigned int j = Inicio(k); j < Fin(k); ++j) filaS[j] += vik * renglon[k][j];
+        }
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizTriangular::Resolver(const Matriz &b) const
+{
+    if (n != b.m)
+        throw "Dimensiones incompatibles para resolver el sistema";
+
+    Matriz x(b.m, b.n);
+    // Sustitucin hacia adelante (inferior) o hacia atrs (superior), un rengln completo a la vez
+    for (unsigned int paso = 0; paso < n; ++paso) {
+        const unsigned int i = inferior ? paso : n - 1 - paso;
+        const tipo pivote = renglon[i][i];
+        if (pivote == 0) throw "La matriz es singular";
+
+        tipo *filaX = x.componente[i];
+        for (unsigned int j = 0; j < b.n; ++j) filaX[j] = b.componente[i][j];
+        for (unsigned int k = Inicio(i); k < Fin(i); ++k) {
+            if (k == i) continue;
+            const tipo tik = renglon[i][k];
+            const tipo *filaK = x.componente[k];
+            for (unsigned int j = 0; j < b.n; ++j) filaX[j] -= tik * filaK[j];
+        }
+        for (unsigned int j = 0; j < b.n; ++j) filaX[j] /= pivote;
+    }
+    return x;
+}
+//***********************************
+Matriz MatrizTriangular::ADensa() const
+{
+    Matriz s(n, n);
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = Inicio(i); j < Fin(i); ++j) s.componente[i][j] = renglon[i][j];
+    }
+    return s;
+}
+
+
+/* FUNCIONES EXTERNAS*/
+//*****************************************************************
+std::ostream & operator<<(std::ostream &out, const MatrizTriangular &v)
+{
+    return out << v.ADensa();
+}
+//**************************************************************
+std::istream & operator>>(std::istream &in, MatrizTriangular &v)
+{
+    for (unsigned int i = 0; i < v.n; ++i) {
+        for (unsigned int j = v.Inicio(i); j < v.Fin(i); ++j) in >> v.renglon[i][j];
+    }
+    return in;
+}
@@ -0,0 +1,176 @@
+/**
+ * \file MatrizTriangular.hpp
+ * \brief Implementaci&oacute;n de una matriz triangular con almacenamiento compacto
+ */
+
+#ifndef MATRIZTRIANGULAR_HPP_INCLUDED
+#define MATRIZTRIANGULAR_HPP_INCLUDED
+
+#include <iostream>
+#include "Matriz.hpp"
+
+/** \class MatrizTriangular
+ *
+ * Matriz cuadrada triangular superior o inferior. Solo se almacenan los n(n+1)/2 elementos del tringulo,
+ * rengln por rengln. El determinante cuesta O(n) y la solucin de sistemas por sustitucin y el producto
+ * con una matriz densa cuestan O(n^2) por columna.
+ *
+ * Ejemplo de uso:
+ * \code
+    MatrizTriangular l(3, true);   // Triangular inferior
+    Matriz b(3, 1);
+    cin >> l;   // Captura 1, 2 y 3 elementos de los renglones 0, 1 y 2
+    cin >> b;
+    Matriz x = l.Resolver(b);
+    cout << l.Determinante() << endl << x << l;
+ * \endcode
+ */
+class MatrizTriangular {
+    /** \brief Funcin amiga para la sobrecarga del operador de insercin.
+     *
+     * Imprime la matriz en su forma densa.
+     *
+     * \param out El flujo de salida.
+     * \param v La matriz a imprimir.
+     * \return El flujo de salida. Permite la aplicacin en cascada del operador.
+     *
+     */
+    friend std::ostream &operator<<(std::ostream &out, const MatrizTriangular &v);
+
+    /** \brief Funcin amiga para la sobrecarga del operador de extraccin.
+     *
+     * Captura los elementos del tringulo rengln por rengln, de izquierda a derecha.
+     *
+     * \param in El flujo de entrada.
+     * \param v La matriz a capturar.
+     * \return El flujo de entrada. Permite la aplicacin en cascada del operador.
+     *
+     */
+    friend std::istream &operator>>(std::istream &in, MatrizTriangular &v);
+
+public:
+    /** \brief Constructor. Crea una matriz triangular de n x n con ceros.
+     *
+     * \param n Nmero de filas y columnas de la matriz.
+     * \param inferior <b>true</b> para una matriz triangular inferior, <b>false</b> para una superior.
+     *
+     * \pre \b n debe ser un nmero positivo.
+     *
+     * \exception const <b>char *</b> La matriz no puede ser creada o la dimensin no es positiva.
+     */
+    explicit MatrizTriangular(int n = 3, bool inferior = false);
+
+    /** \brief Constructor de copias.
+     *
+     * \param v La matriz a copiar.
+     *
+     * \exception const <b>char *</b> La matriz copia no puede ser creada.
+     */
+    MatrizTriangular(const MatrizTriangular &v);
+
+    /** \brief Constructor a partir de una matriz densa con estructura triangular.
+     *
+     * \param v La matriz densa a convertir.
+     * \param inferior <b>true</b> si \b v es triangular inferior, <b>false</b> si es triangular superior.
+     *
+     * \pre \b v debe ser cuadrada y tener ceros en el tringulo opuesto al indicado.
+     *
+     * \exception const <b>char *</b> La matriz no es cuadrada, no tiene la estructura indicada o no puede ser creada.
+     */
+    MatrizTriangular(const Matriz &v, bool inferior);
+
+    /** \brief Operador de asignacin. Copia una matriz triangular en otra.
+     *
+     * \param v La matriz a copiar.
+     * \return La matriz copia. Permite la aplicacin en cascada del operador.
+     *
+     * \exception const <b>char *</b> La matriz copia no puede ser creada.
+     */
+    MatrizTriangular &operator=(const MatrizTriangular &v);
+
+    /** \brief Destructor.
+     *
+     */
+    ~MatrizTriangular();
+
+    /** \brief Obtiene el nmero de filas (y de columnas) de la matriz.
+     *
+     * \return La dimensin de la matriz.
+     *
+     */
+    int ObtenerDim() const;
+
+    /** \brief Indica si la matriz es triangular inferior.
+     *
+     * \return <b>true</b> si es triangular inferior, <b>false</b> si es triangular superior.
+     *
+     */
+    bool EsInferior() const;
+
+    /** \brief Calcula el determinante como el producto de la diagonal, en O(n).
+     *
+     * \return El determinante de la matriz.
+     *
+     */
+    tipo Determinante() const;
+
+    /** \brief Calcula la transpuesta, que es triangular del tipo opuesto.
+     *
+     * \return La matriz transpuesta.
+     *
+     * \exception const <b>char *</b> La matriz transpuesta no puede ser creada.
+     */
+    MatrizTriangular Transpuesta() const;
+
+    /** \brief Calcula el producto matricial por una matriz densa recorriendo solo el tringulo.
+     *
+     * \param v La matriz densa por la que se multiplica por la derecha.
+     * \return La matriz densa resultante.
+     *
+     * \pre El nmero de filas de \b v debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz Producto(const Matriz &v) const;
+
+    /** \brief Calcula el producto matricial vT de una matriz densa por esta matriz, recorriendo solo el tringulo.
+     *
+     * \param v La matriz densa por la que se multiplica por la izquierda.
+     * \return La matriz densa resultante.
+     *
+     * \pre El nmero de columnas de \b v debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz ProductoPorIzquierda(const Matriz &v) const;
+
+    /** \brief Resuelve el sistema TX = B por sustitucin hacia adelante o hacia atrs.
+     *
+     * \param b La matriz de trminos independientes.
+     * \return La matriz solucin X.
+     *
+     * \pre El nmero de filas de \b b debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las dimensiones son incompatibles, la matriz es singular o la matriz solucin no puede ser creada.
+     */
+    Matriz Resolver(const Matriz &b) const;
+
+    /** \brief Construye la matriz densa equivalente.
+     *
+     * \return La matriz densa de n x n.
+     *
+     * \exception const <b>char *</b> La matriz densa no puede ser creada.
+     */
+    Matriz ADensa() const;
+
+private:
+    unsigned int n;
+    bool inferior;
+    tipo **renglon = NULL;
+    void EstablecerDim(int n);
+    void Construir();
+    unsigned int Inicio(unsigned int i) const;
+    unsigned int Fin(unsigned int i) const;
+};
+
+#endif // MATRIZTRIANGULAR_HPP_INCLUDED
@@ -0,0 +1,202 @@
+#include <vector>
+#include <algorithm>
+
+#include "MatrizTridiagonal.hpp"
+
+
+//***************************************************
+void MatrizTridiagonal::EstablecerDim(int n)
+{
+    if (n < 1)throw "Valor fuera de rango";
+    this->n = n;
+}
+//***************************************************
+// Reserva las tres diagonales en un solo bloque: n principales, n-1 inferiores y n-1 superiores
+void MatrizTridiagonal::Construir()
+{
+    try {
+        diagonal = new tipo[3 * n - 2];
+    } catch(std::bad_alloc &) {
+        throw "No es posible construir una MatrizTridiagonal";
+    }
+    inferior = diagonal + n;
+    superior = inferior + (n - 1);
+}
+
+//***********************************
+//Constructor
+MatrizTridiagonal::MatrizTridiagonal(int n) {
+    EstablecerDim(n);
+    Construir();
+    for (unsigned int i = 0; i < 3 * this->n - 2; ++i) diagonal[i] = 0;
+}
+
+//***********************************
+// Constructor de copia
+MatrizTridiagonal::MatrizTridiagonal(const MatrizTridiagonal &v) : n(v.n) {
+    Construir();
+    for (unsigned int i = 0; i < 3 * n - 2; ++i) diagonal[i] = v.diagonal[i];
+}
+//***********************************
+// Constructor a partir de una matriz densa
+MatrizTridiagonal::MatrizTridiagonal(const Matriz &v) : MatrizTridiagonal(v.ObtenerNumRen()) {
+    if (v.m != v.n) throw "La matriz no es cuadrada";
+    for (unsigned int i = 0; i < n; ++i) {
+        for (unsigned int j = 0; j < n; ++j) {
+            if ((j + 1 < i || j > i + 1) && v.componente[i][j] != 0) throw "La matriz no es tridiagonal";
+        }
+        diagonal[i] = v.componente[i][i];
+        if (i > 0) inferior[i - 1] = v.componente[i][i - 1];
+        if (i + 1 < n) superior[i] = v.componente[i][i + 1];
+    }
+}
+//***********************************
+// Operador de asignacin
+MatrizTridiagonal & MatrizTridiagonal::operator=(const MatrizTridiagonal &v) {
+    if (this == &v) return *this;
+    if (n != v.n) {
+        // Se reserva en una copia temporal para que un fallo deje intacta esta matriz
+        MatrizTridiagonal temporal(v);
+        std::swap(n, temporal.n);
+        std::swap(diagonal, temporal.diagonal);
+        std::swap(inferior, temporal.inferior);
+        std::swap(superior, temporal.superior);
+        return *this;
+    }
+    for (unsigned int i = 0; i < 3 * n - 2; ++i) diagonal[i] = v.diagonal[i];
+
+    return *this;
+}
+//***********************************
+// Destructor
+MatrizTridiagonal::~MatrizTridiagonal() {
+        delete[] diagonal;
+        diagonal = inferior = superior = nullptr;
+}
+//***********************************
+int MatrizTridiagonal::ObtenerDim() const
+{
+    return n;
+}
+
+//***************************************************************************
+
+/* OPERACIONES */
+//***********************************
+tipo MatrizTridiagonal::Determinante() const
+{
+    // f(k) = d(k-1)f(k-1) - l(k-2)s(k-2)f(k-2), con f(0) = 1 y f(1) = d(0)
+    tipo anterior = 1, actual = diagonal[0];
+    for (unsigned int k = 1; k < n; ++k) {
+        tipo siguiente = diagonal[k] * actual - inferior[k - 1] * superior[k - 1] * anterior;
+        anterior = actual;
+        actual = siguiente;
+    }
+    return actual;
+}
+//***********************************
+Matriz MatrizTridiagonal::Producto(const Matriz &v) const
+{
+    if (n != v.m)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    Matriz s(v.m, v.n);
+    for (unsigned int i = 0; i < n; ++i) {
+        tipo *filaS = s.componente[i];
+        for (unsigned int j = 0; j < v.n; ++j) filaS[j] = diagonal[i] * v.componente[i][j];
+        if (i > 0) {
+            for (unsigned int j = 0; j < v.n; ++j) filaS[j] += inferior[i - 1] * v.componente[i - 1][j];
+        }
+        if (i + 1 < n) {
+            for (unsigned int j = 0; j < v.n; ++j) filaS[j] += superior[i] * v.componente[i + 1][j];
+        }
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizTridiagonal::ProductoPorIzquierda(const Matriz &v) const
+{
+    if (v.n != n)
+        throw "Dimensiones incompatibles para multiplicar";
+
+    // La columna j de T tiene superior[j-1], diagonal[j] e inferior[j] en los renglones j-1, j y j+1
+    Matriz s(v.m, v.n);
+    for (unsigned int i = 0; i < v.m; ++i) {
+        const tipo *filaV = v.componente[i];
+        tipo *filaS = s.componente[i];
+        for (unsigned int j = 0; j < n; ++j) {
+            tipo suma = filaV[j] * diagonal[j];
+            if (j > 0) suma += filaV[j - 1] * superior[j - 1];
+            if (j + 1 < n) suma += filaV[j + 1] * inferior[j];
+            filaS[j] = suma;
+        }
+    }
+    return s;
+}
+//***********************************
+Matriz MatrizTridiagonal::Resolver(const Matriz &b) const
+{
+    if (n != b.m)
+        throw "Dimensiones incompatibles para resolver el sistema";
+
+    Matriz x(b.m, b.n);
+    std::vector<tipo> c;
+    try {
+        c.resize(n);
+    } catch (std::bad_alloc &) {
+        throw "No es posible construir una Matriz";
+    }
+
+    // Eliminacin hacia adelante: c guarda la diagonal superior normalizada
+    tipo pivote = diagonal[0];
+    for (unsigned int i = 0; i < n; ++i) {
+        tipo *filaX = x.componente[i];
+        if (i > 0) {
+            pivote = diagonal[i] - inferior[i - 1] * c[i - 1];
+        }
+        if (pivote == 0) throw "La matriz es singular";
+        c[i] = (i + 1 < n) ? superior[i] / pivote : 0;
+        for (unsigned int j = 0; j < b.n; ++j) {
+            tipo valor = b.componente[i][j];
+            if (i > 0) valor -= inferior[i - 1] * x.componente[i - 1][j];
+            filaX[j] = valor / pivote;
+        }
+    }
+
+    // Sustitucin hacia atrs
+    for (unsigned int i = n - 1; i-- > 0; ) {
+        for (unsigned int j = 0; j < b.n; ++j) {
+            x.componente[i][j] -= c[i] * x.componente[i + 1][j];
+        }
+    }
+    return x;
+}
+//***********************************
+Matriz MatrizTridiagonal::ADensa() const
+{
+    Matriz s(n, n);
+    for (unsigned int i = 0; i < n; ++i) {
+        s.componente[i][i] = diagonal[i];
+        if (i > 0) s.componente[i][i - 1] = inferior[i - 1];
+        if (i + 1 < n) s.componente[i][i + 1] = superior[i];
+    }
+    return s;
+}
+
+
+/* FUNCIONES EXTERNAS*/
+//*****************************************************************
+std::ostream & operator<<(std::ostream &out, const MatrizTridiagonal &v)
+{
+    return out << v.ADensa();
+}
+//**************************************************************
+std::istream & operator>>(std::istream &in, MatrizTridiagonal &v)
+{
+    for (unsigned int i = 0; i < v.n; ++i) {
+        if (i > 0) in >> v.inferior[i - 1];
+        in >> v.diagonal[i];
+        if (i + 1 < v.n) in >> v.superior[i];
+    }
+    return in;
+}
@@ -0,0 +1,162 @@
+/**
+ * \file MatrizTridiagonal.hpp
+ * \brief Implementaci&oacute;n de una matriz tridiagonal con almacenamiento compacto
+ */
+
+#ifndef MATRIZTRIDIAGONAL_HPP_INCLUDED
+#define MATRIZTRIDIAGONAL_HPP_INCLUDED
+
+#include <iostream>
+#include "Matriz.hpp"
+
+/** \class MatrizTridiagonal
+ *
+ * Matriz cuadrada cuyos nicos elementos distintos de cero estn en la diagonal principal y en las diagonales
+ * inmediatamente superior e inferior. Solo se almacenan los 3n-2 elementos de esas diagonales, por lo que el determinante
+ * cuesta O(n) y la solucin de sistemas con el algoritmo de Thomas y el producto con una matriz densa
+ * cuestan O(n) por columna.
+ *
+ * Ejemplo de uso:
+ * \code
+    MatrizTridiagonal t(4);
+    Matriz b(4, 1);
+    cin >> t;   // Captura 2, 3, 3 y 2 elementos de los renglones 0, 1, 2 y 3
+    cin >> b;
+    Matriz x = t.Resolver(b);
+    cout << t.Determinante() << endl << x << t;
+ * \endcode
+ */
+class MatrizTridiagonal {
+    /** \brief Funcin amiga para la sobrecarga del operador de insercin.
+     *
+     * Imprime la matriz en su forma densa.
+     *
+     * \param out El flujo de salida.
+     * \param v La matriz a imprimir.
+     * \return El flujo de salida. Permite la aplicacin en cascada del operador.
+     *
+     */
+    friend std::ostream &operator<<(std::ostream &out, const MatrizTridiagonal &v);
+
+    /** \brief Funcin amiga para la sobrecarga del operador de extraccin.
+     *
+     * Captura los elementos de las tres diagonales rengln por rengln, de izquierda a derecha.
+     *
+     * \param in El flujo de entrada.
+     * \param v La matriz a capturar.
+     * \return El flujo de entrada. Permite la aplicacin en cascada del operador.
+     *
+     */
+    friend std::istream &operator>>(std::istream &in, MatrizTridiagonal &v);
+
+public:
+    /** \brief Constructor. Crea una matriz tridiagonal de n x n con ceros.
+     *
+     * \param n Nmero de filas y columnas de la matriz.
+     *
+     * \pre \b n debe ser un nmero positivo.
+     *
+     * \exception const <b>char *</b> La matriz no puede ser creada o la dimensin no es positiva.
+     */
+    explicit MatrizTridiagonal(int n = 3);
+
+    /** \brief Constructor de copias.
+     *
+     * \param v La matriz a copiar.
+     *
+     * \exception const <b>char *</b> La matriz copia no puede ser creada.
+     */
+    MatrizTridiagonal(const MatrizTridiagonal &v);
+
+    /** \brief Constructor a partir de una matriz densa con estructura tridiagonal.
+     *
+     * \param v La matriz densa a convertir.
+     *
+     * \pre \b v debe ser cuadrada y tener ceros fuera de las tres diagonales centrales.
+     *
+     * \exception const <b>char *</b> La matriz no es cuadrada, no tiene la estructura indicada o no puede ser creada.
+     */
+    explicit MatrizTridiagonal(const Matriz &v);
+
+    /** \brief Operador de asignacin. Copia una matriz tridiagonal en otra.
+     *
+     * \param v La matriz a copiar.
+     * \return La matriz copia. Permite la aplicacin en cascada del operador.
+     *
+     * \exception const <b>char *</b> La matriz copia no puede ser creada.
+     */
+    MatrizTridiagonal &operator=(const MatrizTridiagonal &v);
+
+    /** \brief Destructor.
+     *
+     */
+    ~MatrizTridiagonal();
+
+    /** \brief Obtiene el nmero de filas (y de columnas) de la matriz.
+     *
+     * \return La dimensin de la matriz.
+     *
+     */
+    int ObtenerDim() const;
+
+    /** \brief Calcula el determinante con la recurrencia de tres trminos, en O(n).
+     *
+     * \return El determinante de la matriz.
+     *
+     */
+    tipo Determinante() const;
+
+    /** \brief Calcula el producto matricial por una matriz densa recorriendo solo las tres diagonales.
+     *
+     * \param v La matriz densa por la que se multiplica por la derecha.
+     * \return La matriz densa resultante.
+     *
+     * \pre El nmero de filas de \b v debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz Producto(const Matriz &v) const;
+
+    /** \brief Calcula el producto matricial vT de una matriz densa por esta matriz, recorriendo solo las tres diagonales.
+     *
+     * \param v La matriz densa por la que se multiplica por la izquierda.
+     * \return La matriz densa resultante.
+     *
+     * \pre El nmero de columnas de \b v debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las matrices tienen dimensiones incompatibles o la matriz resultante no puede ser creada.
+     */
+    Matriz ProductoPorIzquierda(const Matriz &v) const;
+
+    /** \brief Resuelve el sistema TX = B con el algoritmo de Thomas.
+     *
+     * El algoritmo no hace pivoteo; es estable para matrices diagonalmente dominantes o simtricas positivas
+     * definidas. Si aparece un pivote nulo la matriz se reporta como singular.
+     *
+     * \param b La matriz de trminos independientes.
+     * \return La matriz solucin X.
+     *
+     * \pre El nmero de filas de \b b debe ser igual a la dimensin de la matriz.
+     *
+     * \exception const <b>char *</b> Las dimensiones son incompatibles, la matriz es singular o la matriz solucin no puede ser creada.
+     */
+    Matriz Resolver(const Matriz &b) const;
+
+    /** \brief Construye la matriz densa equivalente.
+     *
+     * \return La matriz densa de n x n.
+     *
+     * \exception const <b>char *</b> La matriz densa no puede ser creada.
+     */
+    Matriz ADensa() const;
+
+private:
+    unsigned int n;
+    tipo *inferior = NULL;
+    tipo *diagonal = NULL;
+    tipo *superior = NULL;
+    void EstablecerDim(int n);
+    void Construir();
+};
+
+#endif // MATRIZTRIDIAGONAL_HPP_INCLUDED